@@ -1002,6 +1002,7 @@ m4_include([m4/lib-ld.m4])
 m4_include([m4/lib-link.m4])
 m4_include([m4/lib-prefix.m4])
 m4_include([m4/libmesh.m4])
+m4_include([m4/openmp.m4])
 m4_include([m4/petsc.m4])
 m4_include([m4/samrai.m4])
 m4_include([m4/silo.m4])
@@ -0,0 +1 @@
+../../src/utilities/PatchScratchArena.h
\ No newline at end of file
@@ -0,0 +1 @@
+../../src/utilities/PatchTaskScheduler.h
\ No newline at end of file
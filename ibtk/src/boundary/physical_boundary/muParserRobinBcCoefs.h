@@ -39,6 +39,7 @@
 #include <ibtk/muParser.h>
 
 // SAMRAI INCLUDES
+#include <ArrayData.h>
 #include <CartesianGridGeometry.h>
 #include <RobinBcCoefStrategy.h>
 
@@ -55,6 +56,14 @@ namespace IBTK
  * SAMRAI::solv::RobinBcCoefStrategy that allows for the run-time specification
  * of (possibly spatially- and temporally-varying) Robin boundary conditions.
  *
+ * Because evaluating the coefficient functions is relatively expensive, and
+ * because the same coefficients are typically requested many times per time
+ * step (e.g., once per application of a linear operator), the coefficient
+ * values are cached for each boundary box.  Cached values are reused whenever
+ * the coefficients are requested again for the same boundary box and either
+ * the coefficient functions do not depend on time or the fill time is
+ * unchanged.
+ *
  * \warning Not all linear solvers in IBTK properly handle time-varying \em
  * homogeneous Robin boundary condition coefficients.  Note, however, that all
  * linear solvers in IBTK are presently designed to support spatially and
@@ -77,6 +86,20 @@ public:
      */
     ~muParserRobinBcCoefs();
 
+    /*!
+     * \brief Return whether the boundary condition coefficients are
+     * independent of time, i.e., none of the coefficient functions depend on
+     * the time variable.
+     */
+    bool
+    isTimeIndependent() const;
+
+    /*!
+     * \brief Clear all cached boundary condition coefficients.
+     */
+    void
+    clearCachedBcCoefs();
+
     /*!
      * \name Implementation of SAMRAI::solv::RobinBcCoefStrategy interface.
      */
@@ -169,6 +192,19 @@ private:
     operator=(
         const muParserRobinBcCoefs& that);
 
+    /*!
+     * \brief Evaluate the coefficient functions on the index box of the
+     * provided arrays.
+     */
+    void
+    computeBcCoefs(
+        SAMRAI::pdat::ArrayData<NDIM,double>& acoef_data,
+        SAMRAI::pdat::ArrayData<NDIM,double>& bcoef_data,
+        SAMRAI::pdat::ArrayData<NDIM,double>& gcoef_data,
+        const SAMRAI::hier::Patch<NDIM>& patch,
+        unsigned int location_index,
+        double fill_time) const;
+
     /*!
      * The Cartesian grid geometry object provides the extents of the
      * computational domain.
@@ -200,6 +236,28 @@ private:
      */
     double* d_parser_time;
     double* d_parser_posn;
+
+    /*!
+     * Whether the coefficient functions are independent of time.
+     */
+    bool d_time_independent;
+
+    /*!
+     * Cached coefficient values for a single boundary box, along with the fill
+     * time and grid spacing for which they were computed.
+     */
+    struct CachedBcCoefs
+    {
+        double fill_time;
+        double dx[NDIM];
+        SAMRAI::tbox::Pointer<SAMRAI::pdat::ArrayData<NDIM,double> > acoef_data, bcoef_data, gcoef_data;
+    };
+
+    /*!
+     * Cached coefficient values, indexed by patch level number, boundary
+     * location index, and coefficient box.
+     */
+    mutable std::map<std::vector<int>,CachedBcCoefs> d_cached_bc_coefs;
 };
 }// namespace IBTK
 
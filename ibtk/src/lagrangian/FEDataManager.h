@@ -49,6 +49,7 @@
 
 // PETSC INCLUDES
 #include <petscsys.h>
+#include <petscvec.h>
 
 // IBTK INCLUDES
 #include <ibtk/libmesh_utilities.h>
@@ -234,6 +235,18 @@ public:
     void
     reinitElementMappings();
 
+    /*!
+     * \brief Indicate that the structural coordinates have been modified, so
+     * that cached adaptive quadrature rules must be recomputed the next time
+     * that they are needed.
+     *
+     * \note When adaptive quadrature is used, this method must be called
+     * whenever the values of the coordinates vector passed to spread() or
+     * interp() change.
+     */
+    void
+    invalidateAdaptiveQuadratureRules();
+
     /*!
      * \return A pointer to the unghosted solution vector associated with the
      * specified system.
@@ -553,6 +566,9 @@ private:
      *
      * In this method, the determination as to whether an element is local or
      * not is based on the position of the bounding box of the element.
+     *
+     * The elements associated with each patch are ordered along a Morton
+     * (Z-order) space-filling curve of the centers of their bounding boxes.
      */
     void
     collectActivePatchElements(
@@ -560,6 +576,28 @@ private:
         int level_number,
         const SAMRAI::hier::IntVector<NDIM>& ghost_width);
 
+    /*!
+     * Determine the adaptive quadrature rule to use for each active patch
+     * element and the total number of quadrature points on each local patch.
+     *
+     * The cached rules are recomputed only when X_vec differs from the vector
+     * used to compute them, or when X_vec has been modified since then.
+     *
+     * \note This method should only be called when d_qrule is a
+     * QAdaptiveGauss quadrature rule.
+     */
+    void
+    updateAdaptiveQuadratureRules(
+        libMesh::NumericVector<double>& X_vec);
+
+    /*!
+     * \return The number of quadrature points associated with the active
+     * elements of the specified local patch.
+     */
+    unsigned int
+    countPatchQuadraturePoints(
+        int local_patch_num);
+
     /*!
      * Collect all ghost DOF indices for the specified collection of elements.
      */
@@ -662,6 +700,23 @@ private:
     std::map<std::string,std::vector<unsigned int> > d_active_patch_ghost_dofs;
     blitz::Array<std::pair<blitz::TinyVector<double,NDIM>,blitz::TinyVector<double,NDIM> >,1> d_active_elem_bboxes;
 
+    /*
+     * Cached adaptive quadrature rule data, along with a flag indicating
+     * whether the coordinates have been modified since it was computed.
+     */
+    blitz::Array<std::vector<unsigned int>,1> d_active_patch_elem_qrule_keys;
+    std::vector<unsigned int> d_active_patch_n_qp;
+    bool d_adaptive_qrules_need_update;
+
+    /*
+     * Scratch buffers used to store and to sort quadrature point data when
+     * spreading.  These are retained between calls to avoid reallocating them
+     * for every patch.
+     */
+    std::vector<double> d_spread_F_JxW_qp, d_spread_X_qp;
+    std::vector<double> d_spread_F_qp_sorted, d_spread_X_qp_sorted;
+    std::vector<std::pair<int,unsigned int> > d_spread_cell_qp;
+
     /*
      * Ghost vectors for the various equation systems.
      */
@@ -38,6 +38,7 @@
 // IBTK INCLUDES
 #include <ibtk/HierarchyGhostCellInterpolation.h>
 #include <ibtk/PatchMathOps.h>
+#include <ibtk/PatchTaskScheduler.h>
 
 // SAMRAI INCLUDES
 #include <CartesianGridGeometry.h>
@@ -209,6 +210,21 @@ public:
     setCoarsenOperatorName(
         const std::string& coarsen_op_name);
 
+    /*!
+     * \brief Synchronize the coarse-fine interface between levels ln-1 and ln
+     * of a side-centered normal vector field.
+     *
+     * Coarse values on the coarse-fine interface are replaced by restricted
+     * values from level ln, as is done by div() when src1_cf_bdry_synch is
+     * true.  This allows callers that compute patch-level quantities
+     * themselves to perform the same synchronization.
+     */
+    void
+    synchronizeCoarseFineInterface(
+        int data_idx,
+        SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM,double> > data_var,
+        int ln);
+
     /*!
      * \brief Compute the cell-centered curl of a cell-centered vector field
      * using centered differences.
@@ -693,7 +709,10 @@ public:
      * object poisson_spec.  When the operation is being performed on multiple
      * levels of the hierarchy, the appropriately synchronized gradient and
      * divergence operators are employed to obtain a consistent discretization
-     * of the Laplace operator.
+     * of the Laplace operator.  When the operation is being performed on a
+     * single level with spatially constant scalar-valued diffusivity, the
+     * patches of the level are processed concurrently when threaded execution
+     * is enabled (see PatchTaskScheduler).
      *
      * \see setPatchHierarchy
      * \see resetLevels
@@ -728,6 +747,9 @@ public:
      * damping factor C and diffusivity D be spatially constant and
      * scalar-valued.
      *
+     * The patches of each level are processed concurrently when threaded
+     * execution is enabled (see PatchTaskScheduler).
+     *
      * \see setPatchHierarchy
      * \see resetLevels
      */
@@ -1032,6 +1054,48 @@ public:
         int alpha_depth=0,
         int beta_depth=0);
 
+    /*!
+     * \brief Compute dst = sum_k coefs[k] src[k], pointwise.
+     *
+     * The linear combination is computed in a single traversal of each patch
+     * in the range of levels, rather than one traversal per term.  This is
+     * intended for assembling right-hand sides from several contributions,
+     * e.g., the output of grad(), div(), or laplace() along with source terms.
+     * The patch data index dst_idx may appear among the src_idxs.  The patches
+     * of each level are processed concurrently when threaded execution is
+     * enabled (see PatchTaskScheduler).
+     *
+     * \see setPatchHierarchy
+     * \see resetLevels
+     */
+    void
+    linearSum(
+        int dst_idx,
+        SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM,double> > dst_var,
+        const std::vector<double>& coefs,
+        const std::vector<int>& src_idxs);
+
+    /*!
+     * \brief Compute dst = sum_k coefs[k] src[k], pointwise.
+     *
+     * The linear combination is computed in a single traversal of each patch
+     * in the range of levels, rather than one traversal per term.  This is
+     * intended for assembling right-hand sides from several contributions,
+     * e.g., the output of grad(), div(), or laplace() along with source terms.
+     * The patch data index dst_idx may appear among the src_idxs.  The patches
+     * of each level are processed concurrently when threaded execution is
+     * enabled (see PatchTaskScheduler).
+     *
+     * \see setPatchHierarchy
+     * \see resetLevels
+     */
+    void
+    linearSum(
+        int dst_idx,
+        SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM,double> > dst_var,
+        const std::vector<double>& coefs,
+        const std::vector<int>& src_idxs);
+
     /*!
      * \brief Compute dst = |src|_1, pointwise.
      *
@@ -1202,8 +1266,10 @@ private:
     SAMRAI::tbox::Pointer<SAMRAI::math::HierarchyFaceDataOpsReal<NDIM,double> > d_hier_fc_data_ops;
     SAMRAI::tbox::Pointer<SAMRAI::math::HierarchySideDataOpsReal<NDIM,double> > d_hier_sc_data_ops;
 
-    // Patch math operations.
+    // Patch math operations and the scheduler used to apply them to the patches
+    // of each level.
     PatchMathOps d_patch_math_ops;
+    PatchTaskScheduler d_patch_task_scheduler;
 
     // The cell weights are used to compute norms of data defined on the patch
     // hierarchy.
@@ -579,6 +579,32 @@ public:
         int l=0,
         int m=0) const;
 
+    /*!
+     * \brief Compute dst = sum_k coefs[k] src[k], pointwise, in a single pass
+     * over the patch interior.
+     *
+     * \note dst may be the same as any of the src data.
+     */
+    void
+    linearSum(
+        SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM,double> > dst,
+        const std::vector<double>& coefs,
+        const std::vector<SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM,double> > >& src,
+        SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch) const;
+
+    /*!
+     * \brief Compute dst = sum_k coefs[k] src[k], pointwise, in a single pass
+     * over the patch interior.
+     *
+     * \note dst may be the same as any of the src data.
+     */
+    void
+    linearSum(
+        SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM,double> > dst,
+        const std::vector<double>& coefs,
+        const std::vector<SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM,double> > >& src,
+        SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch) const;
+
     /*!
      * \brief Compute dst = |src|_1, pointwise.
      *
@@ -45,6 +45,7 @@
 #include <ibtk/CoarseFineBoundaryRefinePatchStrategy.h>
 #include <ibtk/FACPreconditionerStrategy.h>
 #include <ibtk/HierarchyMathOps.h>
+#include <ibtk/PatchTaskScheduler.h>
 
 // SAMRAI INCLUDES
 #include <CoarsenAlgorithm.h>
@@ -230,6 +231,20 @@ public:
      * Select from:
      * - \c "additive"
      * - \c "multiplicative"
+     * - \c "red_black"
+     *
+     * The \c "red_black" smoother is additive between patches and uses
+     * red-black Gauss-Seidel on each patch, performing all sweeps and
+     * updating all data depths in a single temporally blocked pass over the
+     * patch.  It is used only when the problem coefficients are
+     * constant.  Problems with spatially variable coefficients are smoothed
+     * using symmetric Gauss-Seidel sweeps with cached patch stencil
+     * coefficients, except for problems with non-grid aligned anisotropy,
+     * which use the PETSc patch smoothers.
+     *
+     * The patches of a level are smoothed concurrently when threaded execution
+     * is enabled (see PatchTaskScheduler), except when the \c "multiplicative"
+     * smoother or the PETSc patch smoothers are used.
      *
      * \note The smoother is always additive between processors ("processor
      * block Gauss-Seidel").
@@ -245,6 +260,12 @@ public:
      * - \c "block_jacobi"
      * - \c "hypre"
      * - \c "petsc"
+     *
+     * The \c "petsc" solver uses an assembled matrix for the coarsest level.
+     * At large scale, that matrix may be agglomerated onto small groups of
+     * processors, each of which solves the coarsest level problem
+     * redundantly, by setting \p agglomeration_num_ranks in the \p
+     * petsc_solver input database; see class CCPoissonPETScLevelSolver.
      */
     void
     setCoarsestLevelSolverChoice(
@@ -506,6 +527,23 @@ private:
 
     //\}
 
+    /*!
+     * \brief Smooth the error on a single patch of the specified level.
+     */
+    void
+    smoothErrorOnPatch(
+        SAMRAI::hier::Patch<NDIM>& patch,
+        int patch_counter,
+        SAMRAI::solv::SAMRAIVectorReal<NDIM,double>& error,
+        const SAMRAI::solv::SAMRAIVectorReal<NDIM,double>& residual,
+        int level_num);
+
+    /*
+     * Patch task used to smooth the error on the patches of a level.
+     */
+    class SmoothErrorTask;
+    friend class SmoothErrorTask;
+
     /*!
      * \brief Initialize the hypre bottom solvers.
      */
@@ -519,25 +557,38 @@ private:
     initializePETScLevelSolver();
 
     /*!
-     * \brief Construct a matrix corresponding to a Laplace operator restricted
-     * to a single patch.
+     * \brief Get the coefficients of the Poisson problem on a single patch,
+     * allocating temporary patch data for constant coefficients.
      */
     static void
-    buildPatchLaplaceOperator(
-        Mat& A,
+    getPatchLaplaceCoefficients(
+        SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM,double> >& C_data,
+        SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM,double> >& D_data,
         const SAMRAI::solv::PoissonSpecifications& poisson_spec,
-        SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
-        const SAMRAI::hier::IntVector<NDIM>& ghost_cell_width);
+        SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch);
+
+    /*!
+     * \brief Compute the stencil coefficients of a Laplace operator with
+     * isotropic diffusion or grid aligned anisotropy restricted to a single
+     * patch.
+     *
+     * The coefficients for each cell are stored contiguously in the order
+     * (1/diagonal, x-lower, x-upper, y-lower, y-upper[, z-lower, z-upper]).
+     */
+    static void
+    buildPatchLaplaceStencil(
+        std::vector<double>& stencil_coefs,
+        const SAMRAI::solv::PoissonSpecifications& poisson_spec,
+        SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch);
 
     /*!
      * \brief Construct a matrix corresponding to a Laplace operator restricted
-     * to a single patch with grid aligned anisotropy.
+     * to a single patch.
      */
     static void
-    buildPatchLaplaceOperator_aligned(
+    buildPatchLaplaceOperator(
         Mat& A,
-        SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM,double> > C_data,
-        SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM,double> > D_data,
+        const SAMRAI::solv::PoissonSpecifications& poisson_spec,
         SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
         const SAMRAI::hier::IntVector<NDIM>& ghost_cell_width);
 
@@ -581,13 +632,19 @@ private:
     /*
      * Mappings from patch indices to patch operators.
      */
-    bool d_using_petsc_smoothers;
+    bool d_using_petsc_smoothers, d_using_vc_smoothers;
     SAMRAI::hier::IntVector<NDIM> d_gcw;
     std::vector<std::vector<Vec> > d_patch_vec_e, d_patch_vec_f;
     std::vector<std::vector<Mat> > d_patch_mat;
+    std::vector<std::vector<std::vector<double> > > d_patch_stencil_coefs;
     std::vector<std::vector<SAMRAI::hier::BoxList<NDIM> > > d_patch_bc_box_overlap;
     std::vector<std::vector<std::map<int,SAMRAI::hier::Box<NDIM> > > > d_patch_smoother_bc_boxes;
 
+    /*
+     * Scheduler used to smooth the error on the patches of a level.
+     */
+    PatchTaskScheduler d_patch_task_scheduler;
+
     /*
      * Reference patch hierarchy and range of levels involved in the solve.
      *
@@ -63,6 +63,7 @@
 // C++ STDLIB INCLUDES
 #include <ostream>
 #include <string>
+#include <vector>
 
 /////////////////////////////// CLASS DEFINITION /////////////////////////////
 
@@ -99,6 +100,7 @@ namespace IBTK
  * values): \verbatim
 
  enable_logging = FALSE         // see enableLogging()
+ reuse_setup = TRUE             // reuse the hypre setup when the linear system is unchanged
  solver_type = "PFMG"           // choices are: "PFMG", "SMG", "PCG", "GMRES", "FlexGMRES" , "LGMRES", "BiCGSTAB"
  precond_type = "none"          // choices are: "PFMG", "SMG", "Jacobi", "none"
  max_iterations = 10            // see setMaxIterations()
@@ -114,6 +116,13 @@ namespace IBTK
  two_norm = 1                   // see hypre User's Manual (only used by PCG solver)
  \endverbatim
  *
+ * When \p reuse_setup is enabled, the hypre matrix and solver setup are retained
+ * when the solver state is deallocated and are reused by the next call to
+ * initializeSolverState() if the level configuration, the (constant) problem
+ * coefficients, and the homogeneous boundary condition coefficients are all
+ * unchanged.  The setup is never reused when the problem coefficients are
+ * spatially variable.
+ *
  * \em hypre is developed in the Center for Applied Scientific Computing (CASC)
  * at Lawrence Livermore National Laboratory (LLNL).  For more information about
  * \em hypre, see <A HREF="http://www.llnl.gov/CASC/linear_solvers">
@@ -180,6 +189,10 @@ public:
 
     /*!
      * \brief Set the data depth used for the solution and rhs data.
+     *
+     * \note The data depth may be changed between calls to solveSystem()
+     * without re-initializing the solver state, so that the same solver setup
+     * may be used to solve for multiple data depths.
      */
     void
     setDataDepth(
@@ -426,6 +439,9 @@ private:
     void
     setupHypreSolver();
     bool
+    computeSetupFingerprint(
+        std::vector<double>& fingerprint);
+    bool
     solveSystem(
         int x_idx,
         int b_idx);
@@ -509,6 +525,17 @@ private:
 
     //\}
 
+    /*!
+     * \name Data used to determine whether the hypre setup may be reused.
+     */
+    //\{
+    bool d_reuse_setup;
+    bool d_hypre_data_allocated;
+    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > d_setup_hierarchy;
+    SAMRAI::solv::RobinBcCoefStrategy<NDIM>* d_setup_bc_coef;
+    std::vector<double> d_setup_fingerprint;
+    //\}
+
     /*!
      * \name hypre objects.
      */
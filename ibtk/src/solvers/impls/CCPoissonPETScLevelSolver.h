@@ -90,8 +90,21 @@ namespace IBTK
  relative_residual_tol = 1.0e-6 // see setRelativeTolerance()
  enable_logging = FALSE         // see enableLogging()
  options_prefix = "petsc_"      // see setOptionsPrefix()
+ agglomeration_num_ranks = 0    // if positive, solve on agglomerated copies of the system (see below)
  \endverbatim
  *
+ * When \p agglomeration_num_ranks is positive, the assembled level operator is
+ * gathered onto subcommunicators consisting of at most \p
+ * agglomeration_num_ranks processors using the PETSc PCREDUNDANT
+ * preconditioner, and each subcommunicator solves the complete system.  By
+ * default, the redundant solve uses a direct solver, but this may be changed
+ * (e.g., to an algebraic multigrid solver) through the PETSc options database
+ * via the options prefix \c "<options_prefix>redundant_".  Agglomerated solves
+ * always use a zero initial guess.  When \f$ C = 0 \f$ and the domain is
+ * periodic in every direction, the level operator is singular; in this case,
+ * zero pivots in the redundant factorization are perturbed, and the
+ * right-hand side must be consistent (e.g., have zero mean).
+ *
  * PETSc is developed ate the Argonne National Laboratory Mathematics and
  * Computer Science Division.  For more information about \em PETSc, see <A
  * HREF="http://www.mcs.anl.gov/petsc/petsc-as">http://www.mcs.anl.gov/petsc/petsc-as</A>.
@@ -460,6 +473,7 @@ private:
      */
     //\{
     std::string d_options_prefix;
+    int d_agglomeration_num_ranks;
     KSP d_petsc_ksp;
     Mat d_petsc_mat;
     Vec d_petsc_x, d_petsc_b;
@@ -45,6 +45,7 @@
 #include <ibtk/SCPoissonHypreLevelSolver.h>
 #include <ibtk/SCPoissonPETScLevelSolver.h>
 #include <ibtk/HierarchyMathOps.h>
+#include <ibtk/PatchTaskScheduler.h>
 
 // SAMRAI INCLUDES
 #include <CoarsenAlgorithm.h>
@@ -200,6 +201,17 @@ public:
      * Select from:
      * - \c "additive"
      * - \c "multiplicative"
+     * - \c "red_black"
+     *
+     * The \c "red_black" smoother is additive between patches and uses
+     * red-black Gauss-Seidel on each patch, performing all sweeps and
+     * updating all data depths in a single temporally blocked pass over the
+     * patch.  It is used only when the problem coefficients are
+     * constant; otherwise, the PETSc patch smoothers are used.
+     *
+     * The patches of a level are smoothed concurrently when threaded execution
+     * is enabled (see PatchTaskScheduler), except when the \c "multiplicative"
+     * smoother or the PETSc patch smoothers are used.
      *
      * \note The smoother is always additive between processors ("processor
      * block Gauss-Seidel").
@@ -215,6 +227,12 @@ public:
      * - \c "block_jacobi"
      * - \c "hypre"
      * - \c "petsc"
+     *
+     * The \c "petsc" solver uses an assembled matrix for the coarsest level.
+     * At large scale, that matrix may be agglomerated onto small groups of
+     * processors, each of which solves the coarsest level problem
+     * redundantly, by setting \p agglomeration_num_ranks in the \p
+     * petsc_solver input database; see class SCPoissonPETScLevelSolver.
      */
     void
     setCoarsestLevelSolverChoice(
@@ -483,6 +501,23 @@ private:
 
     //\}
 
+    /*!
+     * \brief Smooth the error on a single patch of the specified level.
+     */
+    void
+    smoothErrorOnPatch(
+        SAMRAI::hier::Patch<NDIM>& patch,
+        int patch_counter,
+        SAMRAI::solv::SAMRAIVectorReal<NDIM,double>& error,
+        const SAMRAI::solv::SAMRAIVectorReal<NDIM,double>& residual,
+        int level_num);
+
+    /*
+     * Patch task used to smooth the error on the patches of a level.
+     */
+    class SmoothErrorTask;
+    friend class SmoothErrorTask;
+
     /*!
      * \brief Initialize the hypre bottom solver.
      */
@@ -542,6 +577,11 @@ private:
     std::vector<std::vector<blitz::TinyVector<SAMRAI::hier::BoxList<NDIM>,NDIM> > > d_patch_bc_box_overlap;
     std::vector<std::vector<blitz::TinyVector<std::map<int,SAMRAI::hier::Box<NDIM> >,NDIM> > > d_patch_smoother_bc_boxes;
 
+    /*
+     * Scheduler used to smooth the error on the patches of a level.
+     */
+    PatchTaskScheduler d_patch_task_scheduler;
+
     /*
      * Reference patch hierarchy and range of levels involved in the solve.
      *
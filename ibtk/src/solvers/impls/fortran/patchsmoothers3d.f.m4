@@ -186,3 +186,191 @@ c
       end
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Red-black Gauss-Seidel sweeps for F = alpha div grad U + beta U,
+c     applied to all data depths.
+c
+c     The updates of each color are performed using stride-two inner
+c     loops that do not contain any branches, so that they may be
+c     vectorized, and all data depths are updated for each row before
+c     proceeding to the next row.
+c
+c     The sweeps are temporally blocked: all half-sweeps are performed
+c     in a single pass over the patch, with half-sweep h lagging one
+c     plane behind half-sweep h-1.  The planes updated by each
+c     half-sweep therefore depend only on planes that have already been
+c     updated by the preceding half-sweep, so the results are identical
+c     to those obtained by performing the sweeps one after another, but
+c     only the most recently updated 2*sweeps+1 planes need to remain in
+c     cache.  Because updates of the same color are independent, the
+c     rows of each plane may also be distributed among threads when
+c     OpenMP is enabled.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine rbgssmoothdepths3d(
+     &     U,U_gcw,
+     &     alpha,beta,
+     &     F,F_gcw,
+     &     depth,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     ilower2,iupper2,
+     &     dx,
+     &     sweeps)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER ilower2,iupper2
+      INTEGER U_gcw,F_gcw
+      INTEGER depth
+      INTEGER sweeps
+
+      REAL alpha,beta
+
+      REAL F(ilower0-F_gcw:iupper0+F_gcw,
+     &       ilower1-F_gcw:iupper1+F_gcw,
+     &       ilower2-F_gcw:iupper2+F_gcw,
+     &       0:depth-1)
+
+      REAL dx(0:NDIM-1)
+c
+c     Input/Output.
+c
+      REAL U(ilower0-U_gcw:iupper0+U_gcw,
+     &       ilower1-U_gcw:iupper1+U_gcw,
+     &       ilower2-U_gcw:iupper2+U_gcw,
+     &       0:depth-1)
+c
+c     Local variables.
+c
+      INTEGER i0,i1,i2,d,h,s,i0start
+      REAL    fac0,fac1,fac2,fac
+c
+c     Perform one or more red-black Gauss-Seidel sweeps.
+c
+      fac0 = alpha/(dx(0)*dx(0))
+      fac1 = alpha/(dx(1)*dx(1))
+      fac2 = alpha/(dx(2)*dx(2))
+      fac = 0.5d0/(fac0+fac1+fac2-0.5d0*beta)
+
+c$omp parallel default(shared) private(s,h,i0,i1,i2,d,i0start)
+      do s = ilower2,iupper2+2*sweeps-1
+         do h = 0,2*sweeps-1
+            i2 = s-h
+            if ( (i2 .ge. ilower2) .and. (i2 .le. iupper2) ) then
+c$omp do
+               do i1 = ilower1,iupper1
+                  i0start = ilower0+iand(ilower0+i1+i2+h,1)
+                  do d = 0,depth-1
+                     do i0 = i0start,iupper0,2
+                        U(i0,i1,i2,d) = fac*(
+     &                       fac0*(U(i0-1,i1,i2,d)+U(i0+1,i1,i2,d)) +
+     &                       fac1*(U(i0,i1-1,i2,d)+U(i0,i1+1,i2,d)) +
+     &                       fac2*(U(i0,i1,i2-1,d)+U(i0,i1,i2+1,d)) -
+     &                       F(i0,i1,i2,d))
+                     enddo
+                  enddo
+               enddo
+c$omp end do
+            endif
+         enddo
+      enddo
+c$omp end parallel
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Symmetric Gauss-Seidel sweeps for F = C U + div D grad U with
+c     spatially variable coefficients, applied to all data depths.
+c
+c     The stencil coefficients are provided for each cell in the order
+c     (1/diagonal, x-lower, x-upper, y-lower, y-upper, z-lower, z-upper).
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine vcgssmoothdepths3d(
+     &     U,U_gcw,
+     &     A,
+     &     F,F_gcw,
+     &     depth,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     ilower2,iupper2,
+     &     sweeps)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER ilower2,iupper2
+      INTEGER U_gcw,F_gcw
+      INTEGER depth
+      INTEGER sweeps
+
+      REAL A(0:2*NDIM,
+     &       ilower0:iupper0,
+     &       ilower1:iupper1,
+     &       ilower2:iupper2)
+
+      REAL F(ilower0-F_gcw:iupper0+F_gcw,
+     &       ilower1-F_gcw:iupper1+F_gcw,
+     &       ilower2-F_gcw:iupper2+F_gcw,
+     &       0:depth-1)
+c
+c     Input/Output.
+c
+      REAL U(ilower0-U_gcw:iupper0+U_gcw,
+     &       ilower1-U_gcw:iupper1+U_gcw,
+     &       ilower2-U_gcw:iupper2+U_gcw,
+     &       0:depth-1)
+c
+c     Local variables.
+c
+      INTEGER i0,i1,i2,d,l
+c
+c     Perform one or more symmetric Gauss-Seidel sweeps.
+c
+      do l = 1,sweeps
+         do d = 0,depth-1
+            do i2 = ilower2,iupper2
+               do i1 = ilower1,iupper1
+                  do i0 = ilower0,iupper0
+                     U(i0,i1,i2,d) = A(0,i0,i1,i2)*(F(i0,i1,i2,d) -
+     &                    A(1,i0,i1,i2)*U(i0-1,i1,i2,d) -
+     &                    A(2,i0,i1,i2)*U(i0+1,i1,i2,d) -
+     &                    A(3,i0,i1,i2)*U(i0,i1-1,i2,d) -
+     &                    A(4,i0,i1,i2)*U(i0,i1+1,i2,d) -
+     &                    A(5,i0,i1,i2)*U(i0,i1,i2-1,d) -
+     &                    A(6,i0,i1,i2)*U(i0,i1,i2+1,d))
+                  enddo
+               enddo
+            enddo
+            do i2 = iupper2,ilower2,-1
+               do i1 = iupper1,ilower1,-1
+                  do i0 = iupper0,ilower0,-1
+                     U(i0,i1,i2,d) = A(0,i0,i1,i2)*(F(i0,i1,i2,d) -
+     &                    A(1,i0,i1,i2)*U(i0-1,i1,i2,d) -
+     &                    A(2,i0,i1,i2)*U(i0+1,i1,i2,d) -
+     &                    A(3,i0,i1,i2)*U(i0,i1-1,i2,d) -
+     &                    A(4,i0,i1,i2)*U(i0,i1+1,i2,d) -
+     &                    A(5,i0,i1,i2)*U(i0,i1,i2-1,d) -
+     &                    A(6,i0,i1,i2)*U(i0,i1,i2+1,d))
+                  enddo
+               enddo
+            enddo
+         enddo
+      enddo
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
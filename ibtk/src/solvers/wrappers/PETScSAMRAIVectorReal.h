@@ -68,6 +68,16 @@ namespace IBTK
  * through the static member functions that create and destroy PETSc vector
  * objects.
  *
+ * The PETSc "local" reduction operations (e.g., \p VecDot_local and \p
+ * VecMDot_local) are implemented without any interprocessor communication.
+ * Consequently, PETSc may combine several inner products and norms into a
+ * single (possibly non-blocking) global reduction via the split-phase
+ * operations VecDotBegin()/VecDotEnd(), VecMDotBegin()/VecMDotEnd(), and
+ * VecNormBegin()/VecNormEnd().  (Pipelined Krylov methods that rely on this,
+ * such as \p KSPPGMRES and \p KSPPIPECG, are only available in PETSc 3.3 and
+ * 3.4 or later, respectively, and not in the PETSc versions currently
+ * supported by IBTK.)
+ *
  * Finally, we remark that PETSc allows vectors with complex-valued entries.
  * This class and the class SAMRAI::solv::SAMRAIVectorReal assume real-values
  * vectors, i.e., data of type \p double or \p float.  The (currently
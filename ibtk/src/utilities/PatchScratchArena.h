@@ -0,0 +1,219 @@
+// Filename: PatchScratchArena.h
+// Created on 19 Oct 2026 by agent
+//
+// Copyright (c) 2002-2010, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of New York University nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_PatchScratchArena
+#define included_PatchScratchArena
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+// SAMRAI INCLUDES
+#include <tbox/Arena.h>
+
+// C++ STDLIB INCLUDES
+#include <utility>
+#include <vector>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class PatchScratchArena is a SAMRAI::tbox::Arena that provides memory
+ * for temporary patch data objects from a single reusable buffer.
+ *
+ * Memory is handed out from the buffer in a stack-like fashion, and the buffer
+ * is automatically rewound once all outstanding allocations have been freed.
+ * Thus, temporary patch data objects that are allocated with this arena while
+ * processing one patch reuse the same memory when processing the next patch.
+ *
+ * Requests that do not fit in the buffer are satisfied from the heap.  When
+ * the buffer is next rewound, it is enlarged to accommodate the largest amount
+ * of memory that has been simultaneously allocated, so that subsequent uses of
+ * the arena do not require any heap allocation.  The number of heap
+ * allocations, the amount of memory currently allocated, and the high-water
+ * mark of simultaneously allocated memory are recorded to allow this to be
+ * verified.
+ *
+ * \note Patch data objects that are allocated with the arena must not be kept
+ * beyond the processing of a single patch.
+ */
+class PatchScratchArena
+    : public SAMRAI::tbox::Arena
+{
+public:
+    /*!
+     * \brief Constructor.
+     */
+    PatchScratchArena(
+        size_t num_bytes=0);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~PatchScratchArena();
+
+    /*!
+     * \brief Ensure that the buffer is at least the specified size.
+     *
+     * \note The buffer is resized only when there are no outstanding
+     * allocations; otherwise, resizing is deferred until the buffer is next
+     * rewound.
+     */
+    void
+    reserve(
+        size_t num_bytes);
+
+    /*!
+     * \brief Return the size of the buffer.
+     */
+    size_t
+    getBufferSize() const;
+
+    /*!
+     * \brief Return the number of heap allocations performed by the arena
+     * since the last call to resetAllocationCounters().
+     */
+    int
+    getNumHeapAllocations() const;
+
+    /*!
+     * \brief Return the number of allocation requests since the last call to
+     * resetAllocationCounters().
+     */
+    int
+    getNumAllocations() const;
+
+    /*!
+     * \brief Return the number of bytes that are currently allocated from the
+     * arena.
+     */
+    size_t
+    getNumBytesAllocated() const;
+
+    /*!
+     * \brief Return the largest number of bytes that have been simultaneously
+     * allocated from the arena since the last call to
+     * resetAllocationCounters().
+     */
+    size_t
+    getMaxNumBytesAllocated() const;
+
+    /*!
+     * \brief Reset the allocation counters and the high-water mark.
+     */
+    void
+    resetAllocationCounters();
+
+    /*!
+     * \name Implementation of SAMRAI::tbox::Arena interface.
+     */
+    //\{
+
+    /*!
+     * \brief Allocate memory from the arena.
+     */
+    void*
+    alloc(
+        size_t bytes);
+
+    /*!
+     * \brief Return memory to the arena.
+     */
+    void
+    free(
+        void* p);
+
+    //\}
+
+private:
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    PatchScratchArena(
+        const PatchScratchArena& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    PatchScratchArena&
+    operator=(
+        const PatchScratchArena& that);
+
+    /*!
+     * \brief Rewind the buffer, enlarging it if necessary.
+     */
+    void
+    rewind();
+
+    /*
+     * The buffer and the current position within the buffer.
+     */
+    std::vector<char> d_buffer;
+    size_t d_offset;
+
+    /*
+     * The outstanding allocations and their (aligned) sizes.
+     */
+    std::vector<std::pair<void*,size_t> > d_outstanding_allocs;
+
+    /*
+     * The amount of memory that is currently allocated, the largest amount of
+     * memory that has been simultaneously allocated since the counters were
+     * last reset, and the size to which the buffer is enlarged when it is next
+     * rewound.
+     */
+    size_t d_bytes_allocated, d_max_bytes_allocated, d_required_buffer_size;
+
+    /*
+     * Allocation counters.
+     */
+    int d_num_allocs, d_num_heap_allocs;
+};
+}// namespace IBTK
+
+/////////////////////////////// INLINE ///////////////////////////////////////
+
+//#include "PatchScratchArena.I"
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_PatchScratchArena
@@ -0,0 +1,304 @@
+// Filename: PatchTaskScheduler.h
+// Created on 19 Oct 2026 by agent
+//
+// Copyright (c) 2002-2010, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of New York University nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_PatchTaskScheduler
+#define included_PatchTaskScheduler
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+// SAMRAI INCLUDES
+#include <Box.h>
+#include <IntVector.h>
+#include <Patch.h>
+#include <PatchLevel.h>
+#include <tbox/Pointer.h>
+
+// C++ STDLIB INCLUDES
+#include <vector>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class PatchTaskStrategy is an abstract interface for operations that
+ * are performed independently on each local patch of a patch level by a
+ * PatchTaskScheduler.
+ *
+ * When the scheduler executes tasks concurrently, the following rules apply to
+ * the implementation of executeTask():
+ *
+ * - Patch data values may be modified only on the patch that is passed to the
+ *   task.  When allowsTiling() returns true, modifications are further
+ *   restricted to data values that are owned by the task box (e.g., for
+ *   side-centered data, values on the sides of cells in the task box that are
+ *   not shared with other tiles).  Patch data on other patches may not be
+ *   accessed.
+ *
+ * - SAMRAI::tbox::Pointer reference counts are not thread safe.  Tasks may
+ *   create and destroy Pointer objects that refer to the patch passed to the
+ *   task and to the patch data and patch geometry of that patch.  This is safe
+ *   even when tiling is allowed, because the scheduler never executes tasks
+ *   for the same patch concurrently.  Pointer objects that refer to objects
+ *   shared with other patches (e.g., variables, variable contexts, operators,
+ *   and arenas) must not be copied or destroyed.  In particular, tasks must not
+ *   construct temporary patch data objects using the default SAMRAI memory
+ *   arena.
+ *
+ * - Tasks must not perform communication, allocate or deallocate patch data on
+ *   the level, or use objects that are not thread safe, such as a
+ *   PatchScratchArena shared by all tasks.
+ *
+ * Implementations that cannot satisfy these rules should return false from
+ * allowsThreading(), in which case tasks are always executed serially.
+ */
+class PatchTaskStrategy
+{
+public:
+    /*!
+     * \brief Default constructor.
+     */
+    PatchTaskStrategy();
+
+    /*!
+     * \brief Virtual destructor.
+     */
+    virtual
+    ~PatchTaskStrategy();
+
+    /*!
+     * \brief Perform the operation on the portion of the patch indicated by
+     * the task box.
+     *
+     * \param patch The patch.
+     * \param local_patch_num The position of the patch among the local
+     * patches of the level, in the order in which they are visited by
+     * SAMRAI::hier::PatchLevel::Iterator.
+     * \param task_box The portion of the patch to process.
+     *
+     * \note When tiling is not allowed, the task box is the patch box.
+     */
+    virtual void
+    executeTask(
+        SAMRAI::hier::Patch<NDIM>& patch,
+        int local_patch_num,
+        const SAMRAI::hier::Box<NDIM>& task_box) = 0;
+
+    /*!
+     * \brief Indicate whether the tasks may be executed concurrently.
+     *
+     * The default implementation returns true.
+     */
+    virtual bool
+    allowsThreading() const;
+
+    /*!
+     * \brief Indicate whether a patch may be split into multiple tasks.
+     *
+     * The default implementation returns false.
+     */
+    virtual bool
+    allowsTiling() const;
+
+private:
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    PatchTaskStrategy(
+        const PatchTaskStrategy& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    PatchTaskStrategy&
+    operator=(
+        const PatchTaskStrategy& that);
+};
+
+/*!
+ * \brief Class PatchTaskScheduler executes a PatchTaskStrategy on each local
+ * patch of a patch level, using multiple threads when IBTK is compiled with
+ * OpenMP support (i.e., when IBTK is configured with \c --enable-openmp).
+ *
+ * Patches are ordered from largest to smallest and are handed out to threads
+ * dynamically, so that threads that finish early pick up the remaining work.
+ * Patches that are larger than the maximum tile size may be split into several
+ * tasks when the strategy allows it.  The tiles of a patch are always executed
+ * in order by a single thread, so that tasks for the same patch never execute
+ * concurrently.  Tiling therefore improves cache reuse on large patches, but it
+ * does not distribute the work of a single patch among threads.
+ *
+ * Threaded execution may be disabled for all schedulers via
+ * setThreadedExecution(), in which case tasks are executed serially in patch
+ * order.  Tasks are also executed serially when IBTK is compiled without
+ * OpenMP support, when executing on a single thread, or when called from
+ * within a region that is already executing in parallel.
+ */
+class PatchTaskScheduler
+{
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param max_tile_size The maximum size of the tasks into which patches are
+     * split when the strategy allows tiling.  Nonpositive values indicate that
+     * patches are not split along the corresponding coordinate direction.
+     */
+    PatchTaskScheduler(
+        const SAMRAI::hier::IntVector<NDIM>& max_tile_size=SAMRAI::hier::IntVector<NDIM>(0));
+
+    /*!
+     * \brief Destructor.
+     */
+    ~PatchTaskScheduler();
+
+    /*!
+     * \brief Set the maximum size of the tasks into which patches are split.
+     */
+    void
+    setMaxTileSize(
+        const SAMRAI::hier::IntVector<NDIM>& max_tile_size);
+
+    /*!
+     * \brief Get the maximum size of the tasks into which patches are split.
+     */
+    const SAMRAI::hier::IntVector<NDIM>&
+    getMaxTileSize() const;
+
+    /*!
+     * \brief Execute the strategy on each local patch of the level.
+     */
+    void
+    executeTasks(
+        SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > level,
+        PatchTaskStrategy& strategy);
+
+    /*!
+     * \brief Enable or disable threaded execution for all schedulers.
+     */
+    static void
+    setThreadedExecution(
+        bool threaded_execution);
+
+    /*!
+     * \brief Indicate whether threaded execution is enabled.
+     */
+    static bool
+    getThreadedExecution();
+
+    /*!
+     * \brief Return the number of threads that are available to execute tasks.
+     */
+    static int
+    getNumberOfThreads();
+
+private:
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    PatchTaskScheduler(
+        const PatchTaskScheduler& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    PatchTaskScheduler&
+    operator=(
+        const PatchTaskScheduler& that);
+
+    /*!
+     * \brief Add the tasks for a patch to the task list.
+     */
+    void
+    addPatchTasks(
+        SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+        bool tiling);
+
+    /*!
+     * \brief Execute the tasks for the specified entry in the patch list.
+     */
+    void
+    executePatchTasks(
+        int k,
+        PatchTaskStrategy& strategy);
+
+    /*
+     * The maximum tile size.
+     */
+    SAMRAI::hier::IntVector<NDIM> d_max_tile_size;
+
+    /*
+     * The patch and task lists, which are reused between calls to
+     * executeTasks().  The task boxes of patch k are stored in entries
+     * d_task_box_offsets[k] through d_task_box_offsets[k+1]-1 of d_task_boxes.
+     * The patch pointers are set up before tasks are executed, so that no
+     * reference counts are modified by concurrently executing tasks.
+     */
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > > d_task_patches;
+    std::vector<int> d_task_box_offsets;
+    std::vector<SAMRAI::hier::Box<NDIM> > d_task_boxes;
+    std::vector<int> d_task_order;
+
+    /*
+     * Whether threaded execution is enabled.
+     */
+    static bool s_threaded_execution;
+};
+}// namespace IBTK
+
+/////////////////////////////// INLINE ///////////////////////////////////////
+
+//#include "PatchTaskScheduler.I"
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_PatchTaskScheduler
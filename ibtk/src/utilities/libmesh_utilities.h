@@ -110,6 +110,24 @@ public:
         const ElemType type,
         const blitz::Array<double,2>& X_node,
         const double* const dx)
+        {
+            set_rule(type, get_rule_key(type, X_node, dx));
+            return;
+        }
+
+    /*!
+     * \return A key that identifies the quadrature rule that is appropriate
+     * for an element of the specified type with nodal coordinates X_node.
+     *
+     * For simplices, the key is the number of points used by the 1D Gauss rule
+     * of the same order.  For tensor-product elements, the key encodes the
+     * number of 1D Gauss points used in each coordinate direction.
+     */
+    inline unsigned int
+    get_rule_key(
+        const ElemType type,
+        const blitz::Array<double,2>& X_node,
+        const double* const dx) const
         {
             int n_nodes;
             switch (type)
@@ -194,11 +212,7 @@ public:
                 case EDGE4:
                 {
                     const double l_max = (elem_X[1] - elem_X[0]).size();
-                    const int n = std::min(std::max(min_points,static_cast<int>(std::ceil(d_point_density*l_max/dx_min))),22);
-                    const libMesh::QGauss& q = *d_q1d[n];
-                    _points  = q.get_points();
-                    _weights = q.get_weights();
-                    break;
+                    return num_points(min_points, l_max, dx_min);
                 }
                 case TRI3:
                 case TRI6:
@@ -206,11 +220,7 @@ public:
                     const double l_max = std::max((elem_X[1] - elem_X[0]).size(),
                                                   std::max((elem_X[2] - elem_X[0]).size(),
                                                            (elem_X[2] - elem_X[1]).size()));
-                    const int n = std::min(std::max(min_points,static_cast<int>(std::ceil(d_point_density*l_max/dx_min))),22);
-                    const libMesh::QGauss& q = *d_qtri2d[n];
-                    _points  = q.get_points();
-                    _weights = q.get_weights();
-                    break;
+                    return num_points(min_points, l_max, dx_min);
                 }
                 case QUAD4:
                 case QUAD8:
@@ -218,19 +228,140 @@ public:
                 {
                     const double l_max0 = std::max((elem_X[1] - elem_X[0]).size(),
                                                    (elem_X[2] - elem_X[3]).size());
-                    const int n0 = std::min(std::max(min_points,static_cast<int>(std::ceil(d_point_density*l_max0/dx_min))),22);
-                    const libMesh::QGauss& q0 = *d_q1d[n0];
-
                     const double l_max1 = std::max((elem_X[3] - elem_X[0]).size(),
                                                    (elem_X[2] - elem_X[1]).size());
-                    const int n1 = std::min(std::max(min_points,static_cast<int>(std::ceil(d_point_density*l_max1/dx_min))),22);
-                    const libMesh::QGauss& q1 = *d_q1d[n1];
+                    return encode_rule_key(num_points(min_points, l_max0, dx_min),
+                                           num_points(min_points, l_max1, dx_min));
+                }
+                case TET4:
+                case TET10:
+                {
+                    const double l_max = std::max(std::max((elem_X[1] - elem_X[0]).size(),
+                                                           (elem_X[2] - elem_X[0]).size()),
+                                                  std::max(std::max((elem_X[3] - elem_X[0]).size(),
+                                                                    (elem_X[2] - elem_X[1]).size()),
+                                                           std::max((elem_X[3] - elem_X[1]).size(),
+                                                                    (elem_X[3] - elem_X[2]).size())));
+                    return num_points(min_points, l_max, dx_min);
+                }
+                case HEX8:
+                case HEX20:
+                case HEX27:
+                {
+                    const double l_max0 = std::max(std::max((elem_X[1] - elem_X[0]).size(),
+                                                            (elem_X[2] - elem_X[3]).size()),
+                                                   std::max((elem_X[5] - elem_X[4]).size(),
+                                                            (elem_X[6] - elem_X[7]).size()));
+                    const double l_max1 = std::max(std::max((elem_X[3] - elem_X[0]).size(),
+                                                            (elem_X[2] - elem_X[1]).size()),
+                                                   std::max((elem_X[7] - elem_X[4]).size(),
+                                                            (elem_X[6] - elem_X[5]).size()));
+                    const double l_max2 = std::max(std::max((elem_X[4] - elem_X[0]).size(),
+                                                            (elem_X[5] - elem_X[1]).size()),
+                                                   std::max((elem_X[6] - elem_X[2]).size(),
+                                                            (elem_X[7] - elem_X[3]).size()));
+                    return encode_rule_key(num_points(min_points, l_max0, dx_min),
+                                           num_points(min_points, l_max1, dx_min),
+                                           num_points(min_points, l_max2, dx_min));
+                }
+                default:
+                    TBOX_ERROR("unsupported\n");
+            }
+            return 0;
+        }
+
+    /*!
+     * Set the quadrature points and weights to correspond to the rule
+     * identified by the specified key.
+     *
+     * \note The points and weights for each (element type, rule key) pair are
+     * computed only once and are cached for subsequent use.
+     */
+    inline void
+    set_rule(
+        const ElemType type,
+        const unsigned int key)
+        {
+            std::pair<std::vector<libMesh::Point>,std::vector<libMesh::Real> >& rule = get_rule(type, key);
+            _points  = rule.first;
+            _weights = rule.second;
+            return;
+        }
+
+    /*!
+     * \return The number of quadrature points used by the rule identified by
+     * the specified key.
+     */
+    inline unsigned int
+    n_rule_points(
+        const ElemType type,
+        const unsigned int key)
+        {
+            return get_rule(type, key).first.size();
+        }
+
+private:
+    inline int
+    num_points(
+        const int min_points,
+        const double l_max,
+        const double dx_min) const
+        {
+            return std::min(std::max(min_points,static_cast<int>(std::ceil(d_point_density*l_max/dx_min))),22);
+        }
+
+    static inline unsigned int
+    encode_rule_key(
+        const unsigned int n0,
+        const unsigned int n1,
+        const unsigned int n2=1)
+        {
+            return n0 + 23*(n1 + 23*n2);
+        }
+
+    inline std::pair<std::vector<libMesh::Point>,std::vector<libMesh::Real> >&
+    get_rule(
+        const ElemType type,
+        const unsigned int key)
+        {
+            const std::pair<ElemType,unsigned int> rule_id(type,key);
+            std::map<std::pair<ElemType,unsigned int>,std::pair<std::vector<libMesh::Point>,std::vector<libMesh::Real> > >::iterator it = d_rule_tables.find(rule_id);
+            if (it != d_rule_tables.end()) return it->second;
+
+            std::pair<std::vector<libMesh::Point>,std::vector<libMesh::Real> >& rule = d_rule_tables[rule_id];
+            std::vector<libMesh::Point>& points  = rule.first;
+            std::vector<libMesh::Real>&  weights = rule.second;
+            switch (type)
+            {
+                case EDGE2:
+                case EDGE3:
+                case EDGE4:
+                {
+                    const libMesh::QGauss& q = *d_q1d[key];
+                    points  = q.get_points();
+                    weights = q.get_weights();
+                    break;
+                }
+                case TRI3:
+                case TRI6:
+                {
+                    const libMesh::QGauss& q = *d_qtri2d[key];
+                    points  = q.get_points();
+                    weights = q.get_weights();
+                    break;
+                }
+                case QUAD4:
+                case QUAD8:
+                case QUAD9:
+                {
+                    const libMesh::QGauss& q0 = *d_q1d[ key    %23];
+                    const libMesh::QGauss& q1 = *d_q1d[(key/23)%23];
 
                     const unsigned int n_points0 = q0.n_points();
                     const unsigned int n_points1 = q1.n_points();
 
-                    _points .resize(n_points0 * n_points1);
-                    _weights.resize(n_points0 * n_points1);
+                    points .resize(n_points0 * n_points1);
+                    weights.resize(n_points0 * n_points1);
 
                     const std::vector<libMesh::Point>& points0 = q0.get_points();
                     const std::vector<libMesh::Point>& points1 = q1.get_points();
@@ -243,9 +374,9 @@ public:
                     {
                         for (unsigned int i0 = 0; i0 < n_points0; ++i0, ++qp)
                         {
-                            _points [qp](0) = points0[i0](0);
-                            _points [qp](1) = points1[i1](0);
-                            _weights[qp]    = weights0[i0] * weights1[i1];
+                            points [qp](0) = points0[i0](0);
+                            points [qp](1) = points1[i1](0);
+                            weights[qp]    = weights0[i0] * weights1[i1];
                         }
                     }
                     break;
@@ -253,49 +384,25 @@ public:
                 case TET4:
                 case TET10:
                 {
-                    const double l_max = std::max(std::max((elem_X[1] - elem_X[0]).size(),
-                                                           (elem_X[2] - elem_X[0]).size()),
-                                                  std::max(std::max((elem_X[3] - elem_X[0]).size(),
-                                                                    (elem_X[2] - elem_X[1]).size()),
-                                                           std::max((elem_X[3] - elem_X[1]).size(),
-                                                                    (elem_X[3] - elem_X[2]).size())));
-                    const int n = std::min(std::max(min_points,static_cast<int>(std::ceil(d_point_density*l_max/dx_min))),22);
-                    const libMesh::QGauss& q = *d_qtet3d[n];
-                    _points  = q.get_points();
-                    _weights = q.get_weights();
+                    const libMesh::QGauss& q = *d_qtet3d[key];
+                    points  = q.get_points();
+                    weights = q.get_weights();
                     break;
                 }
                 case HEX8:
                 case HEX20:
                 case HEX27:
                 {
-                    const double l_max0 = std::max(std::max((elem_X[1] - elem_X[0]).size(),
-                                                            (elem_X[2] - elem_X[3]).size()),
-                                                   std::max((elem_X[5] - elem_X[4]).size(),
-                                                            (elem_X[6] - elem_X[7]).size()));
-                    const int n0 = std::min(std::max(min_points,static_cast<int>(std::ceil(d_point_density*l_max0/dx_min))),22);
-                    const libMesh::QGauss& q0 = *d_q1d[n0];
-
-                    const double l_max1 = std::max(std::max((elem_X[3] - elem_X[0]).size(),
-                                                            (elem_X[2] - elem_X[1]).size()),
-                                                   std::max((elem_X[7] - elem_X[4]).size(),
-                                                            (elem_X[6] - elem_X[5]).size()));
-                    const int n1 = std::min(std::max(min_points,static_cast<int>(std::ceil(d_point_density*l_max1/dx_min))),22);
-                    const libMesh::QGauss& q1 = *d_q1d[n1];
-
-                    const double l_max2 = std::max(std::max((elem_X[4] - elem_X[0]).size(),
-                                                            (elem_X[5] - elem_X[1]).size()),
-                                                   std::max((elem_X[6] - elem_X[2]).size(),
-                                                            (elem_X[7] - elem_X[3]).size()));
-                    const int n2 = std::min(std::max(min_points,static_cast<int>(std::ceil(d_point_density*l_max2/dx_min))),22);
-                    const libMesh::QGauss& q2 = *d_q1d[n2];
+                    const libMesh::QGauss& q0 = *d_q1d[ key        %23];
+                    const libMesh::QGauss& q1 = *d_q1d[(key/23    )%23];
+                    const libMesh::QGauss& q2 = *d_q1d[(key/(23*23))%23];
 
                     const unsigned int n_points0 = q0.n_points();
                     const unsigned int n_points1 = q1.n_points();
                     const unsigned int n_points2 = q2.n_points();
 
-                    _points .resize(n_points0 * n_points1 * n_points2);
-                    _weights.resize(n_points0 * n_points1 * n_points2);
+                    points .resize(n_points0 * n_points1 * n_points2);
+                    weights.resize(n_points0 * n_points1 * n_points2);
 
                     const std::vector<libMesh::Point>& points0 = q0.get_points();
                     const std::vector<libMesh::Point>& points1 = q1.get_points();
@@ -312,10 +419,10 @@ public:
                         {
                             for (unsigned int i0 = 0; i0 < n_points0; ++i0, ++qp)
                             {
-                                _points [qp](0) = points0[i0](0);
-                                _points [qp](1) = points1[i1](0);
-                                _points [qp](2) = points2[i2](0);
-                                _weights[qp]    = weights0[i0] * weights1[i1] * weights2[i2];
+                                points [qp](0) = points0[i0](0);
+                                points [qp](1) = points1[i1](0);
+                                points [qp](2) = points2[i2](0);
+                                weights[qp]    = weights0[i0] * weights1[i1] * weights2[i2];
                             }
                         }
                     }
@@ -324,10 +431,9 @@ public:
                 default:
                     TBOX_ERROR("unsupported\n");
             }
-            return;
+            return rule;
         }
 
-private:
     inline void
     init_1D(
         const ElemType /*type*/,
@@ -359,6 +465,7 @@ private:
     libMesh::QGauss* d_qtri2d[23];
     libMesh::QGauss* d_qtet3d[23];
     const double d_point_density;
+    std::map<std::pair<ElemType,unsigned int>,std::pair<std::vector<libMesh::Point>,std::vector<libMesh::Real> > > d_rule_tables;
 };
 
 inline void
@@ -42,6 +42,7 @@
 #include <ibtk/muParser.h>
 
 // SAMRAI INCLUDES
+#include <ArrayData.h>
 #include <CartesianGridGeometry.h>
 #include <tbox/Database.h>
 
@@ -61,6 +62,12 @@ namespace IBTK
  * class CartGridFunction that allows for the run-time specification of
  * (possibly spatially- and temporally-varying) functions which are used to set
  * double precision values on standard SAMRAI SAMRAI::hier::PatchData objects.
+ *
+ * Patch data are set one array component at a time.  The physical coordinates
+ * are tabulated once per patch, and each function is evaluated along
+ * contiguous rows of the array data.  Functions that do not depend on the
+ * spatial coordinates are evaluated once per patch, and functions that do not
+ * depend on the coordinate along a row are evaluated once per row.
  */
 class muParserCartGridFunction
     : public CartGridFunction
@@ -137,6 +144,39 @@ private:
     operator=(
         const muParserCartGridFunction& that);
 
+    /*!
+     * \brief Determine which function is used to set the specified depth and
+     * axis of face- or side-centered data.
+     */
+    static int
+    getFunctionDepth(
+        int parsers_size,
+        int data_depth,
+        int depth,
+        unsigned int axis);
+
+    /*!
+     * \brief Evaluate the specified function at each index in the fill box and
+     * store the result in the specified depth of the array data.
+     *
+     * The fill box is given in the index space of the array data.  Index
+     * direction j of the array data corresponds to the physical coordinate
+     * direction dim_map[j], and cell_centered[d] indicates whether the data
+     * are located at cell centers (rather than cell faces) along physical
+     * coordinate direction d.
+     */
+    void
+    setDataOnArray(
+        SAMRAI::pdat::ArrayData<NDIM,double>& data,
+        int data_depth,
+        const SAMRAI::hier::Box<NDIM>& fill_box,
+        int function_depth,
+        const SAMRAI::hier::Index<NDIM>& patch_lower,
+        const double* XLower,
+        const double* dx,
+        const int* dim_map,
+        const bool* cell_centered);
+
     /*!
      * The Cartesian grid geometry object provides the extents of the
      * computational domain.
@@ -164,6 +204,11 @@ private:
      */
     double d_parser_time;
     blitz::TinyVector<double,NDIM> d_parser_posn;
+
+    /*!
+     * Indicates which position variables are used by each function.
+     */
+    std::vector<blitz::TinyVector<bool,NDIM> > d_parser_uses_posn;
 };
 }// namespace IBTK
 
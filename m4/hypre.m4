@@ -9,6 +9,19 @@ fi
 
 AC_CHECK_HEADER([HYPRE.h],,AC_MSG_ERROR([could not find header file HYPRE.h]))
 
+AC_MSG_CHECKING([for HYPRE_StructVectorSetBoxValues2 (hypre 2.9.0 or newer)])
+AC_COMPILE_IFELSE([AC_LANG_PROGRAM([[
+#include <HYPRE_struct_ls.h>
+]], [[
+(void) HYPRE_StructVectorSetBoxValues2;
+(void) HYPRE_StructVectorGetBoxValues2;
+]])],[HYPRE_HAS_BOX_VALUES2=yes],[HYPRE_HAS_BOX_VALUES2=no])
+AC_MSG_RESULT([$HYPRE_HAS_BOX_VALUES2])
+if test "$HYPRE_HAS_BOX_VALUES2" != "yes"; then
+  AC_MSG_ERROR([hypre 2.9.0 or newer is required
+IBTK requires HYPRE_StructVectorSetBoxValues2() and HYPRE_StructVectorGetBoxValues2()])
+fi
+
 AC_LIB_HAVE_LINKFLAGS([HYPRE])
 LIBS="$LIBHYPRE $LIBS"
 
@@ -0,0 +1,58 @@
+AC_DEFUN([CONFIGURE_OPENMP],[
+
+AC_MSG_CHECKING([for $CXX option to support OpenMP])
+OPENMP_CXXFLAGS=unsupported
+OPENMP_SAVE_CXXFLAGS="$CXXFLAGS"
+for openmp_option in -fopenmp -qopenmp -openmp -xopenmp -mp -qsmp=omp ; do
+  CXXFLAGS="$OPENMP_SAVE_CXXFLAGS $openmp_option"
+  AC_LINK_IFELSE([AC_LANG_PROGRAM([[
+#ifndef _OPENMP
+#error OpenMP is not enabled
+#endif
+#include <omp.h>
+]], [[
+return omp_get_max_threads();
+]])],[OPENMP_CXXFLAGS=$openmp_option])
+  if test "$OPENMP_CXXFLAGS" != "unsupported" ; then
+    break
+  fi
+done
+CXXFLAGS="$OPENMP_SAVE_CXXFLAGS"
+AC_MSG_RESULT([$OPENMP_CXXFLAGS])
+
+if test "$OPENMP_CXXFLAGS" == "unsupported" ; then
+  AC_MSG_ERROR([could not determine how to enable OpenMP support for $CXX
+try modifying the value of the CXXFLAGS and LDFLAGS environment variables,
+or reconfigure without --enable-openmp])
+fi
+CXXFLAGS="$OPENMP_CXXFLAGS $CXXFLAGS"
+LDFLAGS="$OPENMP_CXXFLAGS $LDFLAGS"
+
+# The Fortran test program declares a variable only within an OpenMP
+# conditional compilation line, so that it compiles only when OpenMP is
+# enabled.
+AC_LANG_PUSH([Fortran 77])
+AC_MSG_CHECKING([for $F77 option to support OpenMP])
+OPENMP_FFLAGS=unsupported
+OPENMP_SAVE_FFLAGS="$FFLAGS"
+for openmp_option in $OPENMP_CXXFLAGS -fopenmp -qopenmp -openmp -xopenmp -mp -qsmp=omp ; do
+  FFLAGS="$OPENMP_SAVE_FFLAGS $openmp_option"
+  AC_COMPILE_IFELSE([AC_LANG_PROGRAM([],[[      implicit none
+c$    integer n
+      n = 0]])],[OPENMP_FFLAGS=$openmp_option])
+  if test "$OPENMP_FFLAGS" != "unsupported" ; then
+    break
+  fi
+done
+FFLAGS="$OPENMP_SAVE_FFLAGS"
+AC_MSG_RESULT([$OPENMP_FFLAGS])
+AC_LANG_POP([Fortran 77])
+
+if test "$OPENMP_FFLAGS" == "unsupported" ; then
+  AC_MSG_ERROR([could not determine how to enable OpenMP support for $F77
+try modifying the value of the FFLAGS environment variable,
+or reconfigure without --enable-openmp])
+fi
+FFLAGS="$OPENMP_FFLAGS $FFLAGS"
+
+])
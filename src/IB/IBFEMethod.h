@@ -475,6 +475,21 @@ protected:
         double time,
         unsigned int part);
 
+    /*!
+     * \brief Collect and cache the physical boundary sides of the active patch
+     * elements that are used to impose jump conditions.
+     */
+    void
+    collectJumpConditionBoundarySides(
+        unsigned int part);
+
+    /*!
+     * \brief Free the cached boundary side data.
+     */
+    void
+    clearJumpConditionBoundarySides(
+        unsigned int part);
+
     /*!
      * \brief Initialize the physical coordinates using the supplied coordinate
      * mapping function.  If no function is provided, the initial coordinates
@@ -491,6 +506,22 @@ protected:
     updateCoordinateMapping(
         unsigned int part);
 
+    /*!
+     * \brief Load the specified coordinates into the ghosted IB coordinates
+     * vector, and invalidate cached coordinate-dependent FE data when the
+     * loaded coordinates change.
+     */
+    void
+    updateIBGhostedCoordinates(
+        unsigned int part,
+        libMesh::PetscVector<double>* X_vec);
+
+    /*!
+     * \brief Indicate that the coordinate vectors have been modified.
+     */
+    void
+    resetIBGhostedCoordinates();
+
     /*
      * Indicates whether the integrator should output logging messages.
      */
@@ -520,6 +551,7 @@ protected:
     SAMRAI::hier::IntVector<NDIM> d_ghosts;
     std::vector<libMesh::System*> d_X_systems, d_U_systems, d_F_systems, d_F_dil_bar_systems;
     std::vector<libMesh::PetscVector<double>*> d_X_current_vecs, d_X_new_vecs, d_X_half_vecs, d_X_IB_ghost_vecs;
+    std::vector<const libMesh::PetscVector<double>*> d_X_IB_ghost_source_vecs;
     std::vector<libMesh::PetscVector<double>*> d_U_current_vecs, d_U_new_vecs, d_U_half_vecs;
     std::vector<libMesh::PetscVector<double>*> d_F_half_vecs, d_F_IB_ghost_vecs;
     std::vector<libMesh::PetscVector<double>*> d_F_dil_bar_half_vecs, d_F_dil_bar_IB_ghost_vecs;
@@ -576,6 +608,27 @@ protected:
     std::vector<std::vector<unsigned int> > d_lag_surface_force_fcn_systems;
     std::vector<void*> d_lag_surface_force_fcn_ctxs;
 
+    /*
+     * Cached physical boundary sides of the active patch elements, along with
+     * the grid lines of the background fluid grid that they cross.  The
+     * intersections are recomputed only for sides that have moved since they
+     * were last computed.
+     */
+    struct JumpBdrySideData
+    {
+        libMesh::Elem* elem;
+        unsigned short int side;
+        libMesh::Elem* side_elem;
+        bool at_dirichlet_bdry;
+        std::vector<unsigned int> side_dof_indices;
+        std::vector<double> X_node;
+        bool has_intersections;
+        std::vector<libMesh::Point> intersection_ref_points;
+        std::vector<int> intersection_axes;
+    };
+    std::vector<std::vector<std::vector<JumpBdrySideData> > > d_jump_bdry_sides;
+    std::vector<bool> d_jump_bdry_sides_valid;
+
     /*
      * Nonuniform load balancing data structures.
      */
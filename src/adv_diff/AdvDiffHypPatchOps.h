@@ -46,7 +46,9 @@
 #include <tbox/Pointer.h>
 
 // C++ STDLIB INCLUDES
+#include <map>
 #include <string>
+#include <vector>
 
 /////////////////////////////// CLASS DEFINITION /////////////////////////////
 
@@ -187,6 +189,15 @@ private:
     AdvDiffHypPatchOps&
     operator=(
         const AdvDiffHypPatchOps& that);
+
+    /*
+     * Scratch storage for the divergence of the time-integrated advection
+     * velocity, reused for all patches, along with the number of the call to
+     * conservativeDifferenceOnPatch() in which each buffer was last computed.
+     */
+    std::map<SAMRAI::tbox::Pointer<SAMRAI::pdat::FaceVariable<NDIM,double> >,std::vector<double> > d_u_div_scratch_data;
+    std::map<SAMRAI::tbox::Pointer<SAMRAI::pdat::FaceVariable<NDIM,double> >,unsigned int> d_u_div_scratch_call_num;
+    unsigned int d_num_conservative_difference_calls;
 };
 }// namespace IBAMR
 
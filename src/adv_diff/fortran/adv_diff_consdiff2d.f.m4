@@ -95,22 +95,72 @@ c
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
-c     Update a quantity using flux differencing but include the proper
-c     source term to account for a non-discretely divergence free
+c     Compute the divergence of the time-integrated advection velocity.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine adv_diff_udiv2d(
+     &     dx,
+     &     ifirst0,ilast0,ifirst1,ilast1,
+     &     nufluxgc0,nufluxgc1,
+     &     ndivgc0,ndivgc1,
+     &     uflux0,uflux1,
+     &     div)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ifirst0,ilast0,ifirst1,ilast1
+
+      INTEGER nufluxgc0,nufluxgc1
+      INTEGER ndivgc0,ndivgc1
+
+      REAL dx(0:NDIM-1)
+
+      REAL uflux0(FACE2d0VECG(ifirst,ilast,nufluxgc))
+      REAL uflux1(FACE2d1VECG(ifirst,ilast,nufluxgc))
+c
+c     Input/Output.
+c
+      REAL div(CELL2dVECG(ifirst,ilast,ndivgc))
+c
+c     Local variables.
+c
+      INTEGER ic0,ic1
+c
+c     Compute the divergence of the time-integrated advection velocity.
+c
+      do ic1 = ifirst1,ilast1
+         do ic0 = ifirst0,ilast0
+            div(ic0,ic1) =
+     &           (uflux0(ic0+1,ic1)-uflux0(ic0,ic1))/dx(0)
+     &           + (uflux1(ic1+1,ic0)-uflux1(ic1,ic0))/dx(1)
+         enddo
+      enddo
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Update a quantity using flux differencing and include the source
+c     term to account for a non-discretely divergence free advection
+c     velocity, using a precomputed divergence of the time-integrated
 c     advection velocity.
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
-      subroutine adv_diff_consdiffwithdivsource2d(
+      subroutine adv_diff_consdiffwithudiv2d(
      &     dx,dt,
      &     ifirst0,ilast0,ifirst1,ilast1,
      &     nfluxgc0,nfluxgc1,
      &     nqfluxgc0,nqfluxgc1,
-     &     nufluxgc0,nufluxgc1,
+     &     ndivgc0,ndivgc1,
      &     nqvalgc0,nqvalgc1,
      &     flux0,flux1,
      &     qflux0,qflux1,
-     &     uflux0,uflux1,
+     &     div,
      &     qval)
 c
       implicit none
@@ -123,7 +173,7 @@ c
 
       INTEGER nfluxgc0,nfluxgc1
       INTEGER nqfluxgc0,nqfluxgc1
-      INTEGER nufluxgc0,nufluxgc1
+      INTEGER ndivgc0,ndivgc1
       INTEGER nqvalgc0,nqvalgc1
 
       REAL dx(0:NDIM-1),dt
@@ -134,8 +184,7 @@ c
       REAL qflux0(FACE2d0VECG(ifirst,ilast,nqfluxgc))
       REAL qflux1(FACE2d1VECG(ifirst,ilast,nqfluxgc))
 
-      REAL uflux0(FACE2d0VECG(ifirst,ilast,nufluxgc))
-      REAL uflux1(FACE2d1VECG(ifirst,ilast,nufluxgc))
+      REAL div(CELL2dVECG(ifirst,ilast,ndivgc))
 c
 c     Input/Output.
 c
@@ -157,8 +206,7 @@ c
             divsource = (fourth/(dt**2.d0))*
      &           ( qflux0(ic0+1,ic1) + qflux0(ic0,ic1)
      &           + qflux1(ic1+1,ic0) + qflux1(ic1,ic0) )*
-     &           ( (uflux0(ic0+1,ic1)-uflux0(ic0,ic1))/dx(0)
-     &           + (uflux1(ic1+1,ic0)-uflux1(ic1,ic0))/dx(1) )
+     &           div(ic0,ic1)
 
             qval(ic0,ic1) = divsource
      &           -(flux0(ic0+1,ic1)-flux0(ic0,ic1))/dtdx(0)
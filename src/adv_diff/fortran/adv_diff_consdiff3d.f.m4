@@ -99,22 +99,76 @@ c
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
-c     Update a quantity using flux differencing but include the proper
-c     source term to account for a non-discretely divergence free
+c     Compute the divergence of the time-integrated advection velocity.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine adv_diff_udiv3d(
+     &     dx,
+     &     ifirst0,ilast0,ifirst1,ilast1,ifirst2,ilast2,
+     &     nufluxgc0,nufluxgc1,nufluxgc2,
+     &     ndivgc0,ndivgc1,ndivgc2,
+     &     uflux0,uflux1,uflux2,
+     &     div)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ifirst0,ilast0,ifirst1,ilast1,ifirst2,ilast2
+
+      INTEGER nufluxgc0,nufluxgc1,nufluxgc2
+      INTEGER ndivgc0,ndivgc1,ndivgc2
+
+      REAL dx(0:NDIM-1)
+
+      REAL uflux0(FACE3d0VECG(ifirst,ilast,nufluxgc))
+      REAL uflux1(FACE3d1VECG(ifirst,ilast,nufluxgc))
+      REAL uflux2(FACE3d2VECG(ifirst,ilast,nufluxgc))
+c
+c     Input/Output.
+c
+      REAL div(CELL3dVECG(ifirst,ilast,ndivgc))
+c
+c     Local variables.
+c
+      INTEGER ic0,ic1,ic2
+c
+c     Compute the divergence of the time-integrated advection velocity.
+c
+      do ic2 = ifirst2,ilast2
+         do ic1 = ifirst1,ilast1
+            do ic0 = ifirst0,ilast0
+               div(ic0,ic1,ic2) =
+     &              (uflux0(ic0+1,ic1,ic2)-uflux0(ic0,ic1,ic2))/dx(0)
+     &              + (uflux1(ic1+1,ic2,ic0)-uflux1(ic1,ic2,ic0))/dx(1)
+     &              + (uflux2(ic2+1,ic0,ic1)-uflux2(ic2,ic0,ic1))/dx(2)
+            enddo
+         enddo
+      enddo
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Update a quantity using flux differencing and include the source
+c     term to account for a non-discretely divergence free advection
+c     velocity, using a precomputed divergence of the time-integrated
 c     advection velocity.
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
-      subroutine adv_diff_consdiffwithdivsource3d(
+      subroutine adv_diff_consdiffwithudiv3d(
      &     dx,dt,
      &     ifirst0,ilast0,ifirst1,ilast1,ifirst2,ilast2,
      &     nfluxgc0,nfluxgc1,nfluxgc2,
      &     nqfluxgc0,nqfluxgc1,nqfluxgc2,
-     &     nufluxgc0,nufluxgc1,nufluxgc2,
+     &     ndivgc0,ndivgc1,ndivgc2,
      &     nqvalgc0,nqvalgc1,nqvalgc2,
      &     flux0,flux1,flux2,
      &     qflux0,qflux1,qflux2,
-     &     uflux0,uflux1,uflux2,
+     &     div,
      &     qval)
 c
       implicit none
@@ -127,7 +181,7 @@ c
 
       INTEGER nfluxgc0,nfluxgc1,nfluxgc2
       INTEGER nqfluxgc0,nqfluxgc1,nqfluxgc2
-      INTEGER nufluxgc0,nufluxgc1,nufluxgc2
+      INTEGER ndivgc0,ndivgc1,ndivgc2
       INTEGER nqvalgc0,nqvalgc1,nqvalgc2
 
       REAL dx(0:NDIM-1),dt
@@ -140,9 +194,7 @@ c
       REAL qflux1(FACE3d1VECG(ifirst,ilast,nqfluxgc))
       REAL qflux2(FACE3d2VECG(ifirst,ilast,nqfluxgc))
 
-      REAL uflux0(FACE3d0VECG(ifirst,ilast,nufluxgc))
-      REAL uflux1(FACE3d1VECG(ifirst,ilast,nufluxgc))
-      REAL uflux2(FACE3d2VECG(ifirst,ilast,nufluxgc))
+      REAL div(CELL3dVECG(ifirst,ilast,ndivgc))
 c
 c     Input/Output.
 c
@@ -166,9 +218,7 @@ c
      &              ( qflux0(ic0+1,ic1,ic2) + qflux0(ic0,ic1,ic2)
      &              + qflux1(ic1+1,ic2,ic0) + qflux1(ic1,ic2,ic0)
      &              + qflux2(ic2+1,ic0,ic1) + qflux2(ic2,ic0,ic1) )*
-     &              ( (uflux0(ic0+1,ic1,ic2)-uflux0(ic0,ic1,ic2))/dx(0)
-     &              + (uflux1(ic1+1,ic2,ic0)-uflux1(ic1,ic2,ic0))/dx(1)
-     &              + (uflux2(ic2+1,ic0,ic1)-uflux2(ic2,ic0,ic1))/dx(2))
+     &              div(ic0,ic1,ic2)
 
                qval(ic0,ic1,ic2) = divsource
      &              -(flux0(ic0+1,ic1,ic2)-flux0(ic0,ic1,ic2))/dtdx(0)
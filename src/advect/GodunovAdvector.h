@@ -35,6 +35,9 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+// IBTK INCLUDES
+#include <ibtk/PatchScratchArena.h>
+
 // SAMRAI INCLUDES
 #include <CellData.h>
 #include <FaceData.h>
@@ -116,6 +119,14 @@ public:
     const std::string&
     getName() const;
 
+    /*!
+     * Return the arena used to allocate temporary patch data.  The arena's
+     * allocation counters may be used to verify that the predictors do not
+     * perform heap allocations once the arena has been sized.
+     */
+    SAMRAI::tbox::Pointer<IBTK::PatchScratchArena>
+    getScratchArena() const;
+
     ///
     ///  The following routines:
     ///
@@ -415,6 +426,13 @@ private:
 #if (NDIM == 3)
     bool d_using_full_ctu;
 #endif
+
+    /*
+     * Arena used to allocate the temporary patch data required by the
+     * predictors.  The arena grows to the largest patch encountered, after
+     * which temporaries are allocated without touching the heap.
+     */
+    SAMRAI::tbox::Pointer<IBTK::PatchScratchArena> d_scratch_arena;
 };
 }// namespace IBAMR
 
@@ -40,6 +40,7 @@
 
 // IBTK INCLUDES
 #include <ibtk/GeneralOperator.h>
+#include <ibtk/PatchScratchArena.h>
 
 /////////////////////////////// CLASS DEFINITION /////////////////////////////
 
@@ -92,6 +93,17 @@ public:
     ConvectiveDifferencingType
     getConvectiveDifferencingType() const;
 
+    /*!
+     * \brief Get the arena used to allocate temporary patch data when computing
+     * the convective derivative.
+     *
+     * The allocation counters of the arena may be used to verify that the
+     * operator does not perform any heap allocations once the arena has been
+     * sized.
+     */
+    SAMRAI::tbox::Pointer<IBTK::PatchScratchArena>
+    getScratchArena() const;
+
     /*!
      * \brief Compute N = u * grad Q.
      */
@@ -144,6 +156,12 @@ protected:
      */
     int d_u_idx;
 
+    /*!
+     * Arena used to allocate temporary patch data.  Subclasses should size the
+     * arena in initializeOperatorState().
+     */
+    SAMRAI::tbox::Pointer<IBTK::PatchScratchArena> d_scratch_arena;
+
 private:
     /*!
      * \brief Default constructor.
@@ -66,6 +66,10 @@ namespace IBAMR
  * FACPreconditionerStrategy implementing a box relaxation (Vanka-type) smoother
  * for use as a multigrid preconditioner.
  *
+ * Each box consists of a single cell along with the normal velocities on the
+ * sides of that cell.  The local saddle-point problem associated with each box
+ * is solved in closed form.
+ *
  * \warning This class was originally intended to be used with the SAMRAI class
  * SAMRAI::solv::FACPreconditioner but is now designed to be used with the IBTK
  * class IBTK::FACPreconditioner.
@@ -74,6 +78,7 @@ namespace IBAMR
  * values): \verbatim
 
  smoother_choice = "additive"                   // see setSmootherChoice()
+ box_ordering = "lexicographic"                 // "lexicographic" or "red_black"
 
  U_prolongation_method = "CONSTANT_REFINE"      // see setProlongationMethods()
  P_prolongation_method = "LINEAR_REFINE"        // see setProlongationMethods()
@@ -493,13 +498,6 @@ private:
      */
     SAMRAI::hier::IntVector<NDIM> d_gcw;
 
-    /*
-     * Box operator data.
-     */
-    std::vector<Mat> d_box_op;
-    std::vector<Vec> d_box_e, d_box_r;
-    std::vector<KSP> d_box_ksp;
-
     /*
      * Mappings from patch indices to patch operators.
      */
@@ -545,9 +543,11 @@ private:
     double d_dt;
 
     /*
-     * The kind of smoothing to perform.
+     * The kind of smoothing to perform and the order in which the cell boxes
+     * are relaxed.
      */
     std::string d_smoother_choice;
+    std::string d_box_ordering;
 
     /*
      * The names of the refinement operators used to prolong the coarse grid
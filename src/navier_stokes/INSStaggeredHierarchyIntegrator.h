@@ -356,6 +356,40 @@ private:
     void
     regridProjection();
 
+    /*!
+     * Set the initial guess for the incompressible Stokes solver using the
+     * solutions from preceding time steps.
+     */
+    void
+    setStokesInitialGuess(
+        double current_time,
+        double new_time);
+
+    /*!
+     * Store the solution at the end of the present time step for use in
+     * constructing initial guesses for subsequent solves.
+     */
+    void
+    updateStokesInitialGuessHistory(
+        double current_time,
+        double new_time);
+
+    /*!
+     * Orthonormalize the image of the specified stored solution vector under
+     * the Stokes operator against the images of the preceding stored solution
+     * vectors.  Linearly dependent vectors are discarded, in which case the
+     * function returns false.
+     */
+    bool
+    orthonormalizeStokesInitialGuessVector(
+        unsigned int k);
+
+    /*!
+     * Free the solutions stored for constructing initial guesses.
+     */
+    void
+    freeStokesInitialGuessHistory();
+
     /*!
      * Value indicating the number of solver cycles to be used for the present
      * time step.
@@ -374,7 +408,9 @@ private:
     SAMRAI::tbox::Pointer<INSStaggeredPhysicalBoundaryHelper> d_U_bc_helper;
     blitz::TinyVector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*,NDIM> d_U_bc_coefs;
     SAMRAI::solv::RobinBcCoefStrategy<NDIM>* d_P_bc_coef;
-    SAMRAI::tbox::Pointer<IBTK::SideDataSynchronization> d_side_synch_op;
+    SAMRAI::tbox::Pointer<IBTK::SideDataSynchronization> d_side_synch_op, d_rhs_side_synch_op;
+    SAMRAI::tbox::Pointer<SAMRAI::xfer::CoarsenAlgorithm<NDIM> > d_U_half_coarsen_alg;
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::CoarsenSchedule<NDIM> > > d_U_half_coarsen_scheds;
 
     /*
      * Hierarchy operators and solvers.
@@ -414,6 +450,24 @@ private:
     SAMRAI::tbox::Pointer<IBTK::LinearSolver>              d_stokes_pc;
     bool d_stokes_solver_needs_reinit_when_dt_changes, d_stokes_solver_needs_init;
 
+    /*
+     * Data used to construct initial guesses for the incompressible Stokes
+     * solver.
+     *
+     * Valid initial guess types are: PREVIOUS_SOLUTION (use the most recent
+     * approximation to the solution), EXTRAPOLATION (extrapolate the stored
+     * solutions from preceding time steps to the new time), and PROJECTION
+     * (minimize the residual over the span of the stored solutions).  For
+     * PROJECTION, the stored solution vectors V are transformed so that W = A V
+     * has orthonormal columns.  PROJECTION requires the default Stokes
+     * operator.
+     */
+    std::string d_stokes_initial_guess_type;
+    int d_stokes_initial_guess_history_size;
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM,double> > > d_stokes_guess_sol_vecs, d_stokes_guess_op_vecs;
+    std::vector<double> d_stokes_guess_times;
+    double d_stokes_guess_basis_dt;
+
     /*!
      * Fluid solver variables.
      */
@@ -39,7 +39,9 @@
 #include <ibamr/ConvectiveOperator.h>
 
 // SAMRAI INCLUDES
+#include <IntVector.h>
 #include <RefineAlgorithm.h>
+#include <SideData.h>
 #include <SideVariable.h>
 
 // C++ STDLIB INCLUDES
@@ -84,6 +86,29 @@ public:
         int U_idx,
         int N_idx);
 
+    /*!
+     * \brief Set the size of the tiles used to block the computation of the
+     * convective derivative.
+     *
+     * Patches larger than the tile size are processed one tile at a time, with
+     * the interpolation, reconstruction, and differencing steps all performed on
+     * a tile before proceeding to the next.  Each tile is still processed by
+     * the same sequence of Fortran kernels that is used for an entire patch;
+     * these kernels are not fused into a single pass.  Because each face value depends
+     * only on the velocity within a fixed stencil, the result is identical to
+     * that obtained by processing the entire patch at once.  Nonpositive entries
+     * disable tiling along the corresponding coordinate direction; setting all
+     * entries to zero recovers the patch-by-patch computation.
+     *
+     * By default, tiling is disabled.  Tile sizes of roughly 64 cells in 2D
+     * and 24 cells in 3D keep the working set of a tile in cache on typical
+     * processors, but the tiled results should be compared with those of the
+     * patch-by-patch computation before tiling is enabled in production runs.
+     */
+    void
+    setTileSize(
+        const SAMRAI::hier::IntVector<NDIM>& tile_size);
+
     /*!
      * \name General operator functionality.
      */
@@ -185,6 +210,19 @@ private:
     operator=(
         const INSStaggeredPPMConvectiveOperator& that);
 
+    /*!
+     * \brief Compute the convective derivative of the velocity stored in
+     * U_data on the box of U_data.
+     *
+     * \note U_data must provide sufficient ghost cells for the xsPPM7
+     * reconstruction, and N_data must be defined on the same box as U_data.
+     */
+    void
+    computeConvectiveDerivative(
+        SAMRAI::pdat::SideData<NDIM,double>& N_data,
+        const SAMRAI::pdat::SideData<NDIM,double>& U_data,
+        const double* dx);
+
     // Whether the operator is initialized.
     bool d_is_initialized;
 
@@ -201,6 +239,9 @@ private:
     // Scratch data.
     SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM,double> > d_U_var;
     int d_U_scratch_idx;
+
+    // Tile size used to block the computation of the convective derivative.
+    SAMRAI::hier::IntVector<NDIM> d_tile_size;
 };
 }// namespace IBAMR
 
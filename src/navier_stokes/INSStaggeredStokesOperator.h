@@ -42,6 +42,7 @@
 #include <ibtk/LinearOperator.h>
 #include <ibtk/HierarchyGhostCellInterpolation.h>
 #include <ibtk/HierarchyMathOps.h>
+#include <ibtk/PatchMathOps.h>
 
 /////////////////////////////// CLASS DEFINITION /////////////////////////////
 
@@ -55,6 +56,10 @@ namespace IBAMR
  * This class is intended to be used with an iterative (Krylov or Newton-Krylov)
  * incompressible flow solver.
  *
+ * The momentum and continuity components of the operator are computed together
+ * in a single pass over each patch, following a single combined ghost cell fill
+ * of the velocity and pressure.
+ *
  * \see INSStaggeredHierarchyIntegrator
  */
 class INSStaggeredStokesOperator
@@ -268,6 +273,7 @@ private:
     SAMRAI::solv::RobinBcCoefStrategy<NDIM>* const d_P_bc_coef;
     bool d_homogeneous_bc, d_correcting_rhs;
     SAMRAI::tbox::Pointer<IBTK::HierarchyMathOps> d_hier_math_ops;
+    IBTK::PatchMathOps d_patch_math_ops;
 };
 }// namespace IBAMR
 
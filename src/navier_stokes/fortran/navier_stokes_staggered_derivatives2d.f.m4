@@ -319,3 +319,117 @@ c
       end
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Compute the action of the staggered-grid Stokes operator,
+c
+c         F = C U + D div grad U + grad P
+c         Q = -div U
+c
+c     in a single pass over the patch.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine navier_stokes_staggered_stokes_apply2d(
+     &     dx,
+     &     ifirst0,ilast0,
+     &     ifirst1,ilast1,
+     &     C,D,
+     &     n_U_gc0,n_U_gc1,
+     &     U0,U1,
+     &     n_P_gc0,n_P_gc1,
+     &     P,
+     &     n_F_gc0,n_F_gc1,
+     &     F0,F1,
+     &     n_Q_gc0,n_Q_gc1,
+     &     Q)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ifirst0,ilast0
+      INTEGER ifirst1,ilast1
+
+      INTEGER n_U_gc0,n_U_gc1
+      INTEGER n_P_gc0,n_P_gc1
+      INTEGER n_F_gc0,n_F_gc1
+      INTEGER n_Q_gc0,n_Q_gc1
+
+      REAL dx(0:NDIM-1)
+
+      REAL C,D
+
+      REAL U0(
+     &     SIDE2d0VECG(ifirst,ilast,n_U_gc)
+     &     )
+      REAL U1(
+     &     SIDE2d1VECG(ifirst,ilast,n_U_gc)
+     &     )
+      REAL P(
+     &     CELL2dVECG(ifirst,ilast,n_P_gc)
+     &     )
+c
+c     Output.
+c
+      REAL F0(
+     &     SIDE2d0VECG(ifirst,ilast,n_F_gc)
+     &     )
+      REAL F1(
+     &     SIDE2d1VECG(ifirst,ilast,n_F_gc)
+     &     )
+      REAL Q(
+     &     CELL2dVECG(ifirst,ilast,n_Q_gc)
+     &     )
+c
+c     Local variables.
+c
+      INTEGER i0,i1
+      REAL lap_fac0,lap_fac1
+      REAL grad_fac0,grad_fac1
+      REAL div_fac0,div_fac1
+c
+c     Compute F = C U + D div grad U + grad P.
+c
+      lap_fac0 = D/(dx(0)*dx(0))
+      lap_fac1 = D/(dx(1)*dx(1))
+
+      grad_fac0 = 1.d0/dx(0)
+      grad_fac1 = 1.d0/dx(1)
+
+      do i1 = ifirst1,ilast1
+         do i0 = ifirst0,ilast0+1
+            F0(i0,i1) =
+     &           lap_fac0*(U0(i0-1,i1)+U0(i0+1,i1)-2.d0*U0(i0,i1)) +
+     &           lap_fac1*(U0(i0,i1-1)+U0(i0,i1+1)-2.d0*U0(i0,i1)) +
+     &           C*U0(i0,i1) +
+     &           grad_fac0*(P(i0,i1)-P(i0-1,i1))
+         enddo
+      enddo
+
+      do i1 = ifirst1,ilast1+1
+         do i0 = ifirst0,ilast0
+            F1(i0,i1) =
+     &           lap_fac0*(U1(i0-1,i1)+U1(i0+1,i1)-2.d0*U1(i0,i1)) +
+     &           lap_fac1*(U1(i0,i1-1)+U1(i0,i1+1)-2.d0*U1(i0,i1)) +
+     &           C*U1(i0,i1) +
+     &           grad_fac1*(P(i0,i1)-P(i0,i1-1))
+         enddo
+      enddo
+c
+c     Compute Q = -div U.
+c
+      div_fac0 = -1.d0/dx(0)
+      div_fac1 = -1.d0/dx(1)
+
+      do i1 = ifirst1,ilast1
+         do i0 = ifirst0,ilast0
+            Q(i0,i1) =
+     &           div_fac0*(U0(i0+1,i1)-U0(i0,i1)) +
+     &           div_fac1*(U1(i0,i1+1)-U1(i0,i1))
+         enddo
+      enddo
+c
+      return
+      end
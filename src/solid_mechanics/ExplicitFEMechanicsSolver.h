@@ -260,12 +260,31 @@ public:
 
     /*!
      * Method to advance data from current_time to new_time.
+     *
+     * The structure is advanced using getNumberOfSubsteps(new_time-current_time)
+     * explicit substeps, so that the time step size used by the caller (e.g.,
+     * the fluid solver) is not limited by the stability restriction of the
+     * explicit elasticity solver.
      */
     void
     integrateData(
         double current_time,
         double new_time);
 
+    /*!
+     * \brief Return the number of explicit substeps used to advance the
+     * structure over a time step of size dt.
+     *
+     * The number of substeps is the maximum of the value of input key
+     * num_substeps (default 1) and, if a positive value is provided for input
+     * key wave_speed, the number of substeps required to satisfy the CFL-type
+     * restriction dt_sub <= substep_cfl*h_min/wave_speed, in which h_min is
+     * the minimum element size.
+     */
+    unsigned int
+    getNumberOfSubsteps(
+        double dt) const;
+
     /*!
      * Method to clean up data following call(s) to integrateHierarchy().
      */
@@ -288,6 +307,15 @@ public:
         SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db);
 
 protected:
+    /*!
+     * \brief Advance X^{n+1} and U^{n+1} in place over a single explicit
+     * substep from current_time to new_time.
+     */
+    void
+    integrateSubstep(
+        double current_time,
+        double new_time);
+
     /*
      * \brief Compute the projected dilatational strain F_dil_bar.
      */
@@ -382,6 +410,12 @@ protected:
     std::vector<libMesh::EquationSystems*> d_equation_systems;
 
     const unsigned int d_num_parts;
+
+    /*
+     * System data and integrator work vectors.  The work vectors X^{n+1} and
+     * U^{n+1} persist across time steps and are reallocated only when the
+     * layout of the corresponding system vectors changes.
+     */
     std::vector<libMesh::System*> d_X_systems, d_U_systems, d_F_systems, d_F_dil_bar_systems;
     std::vector<libMesh::PetscVector<double>*> d_X_current_vecs, d_X_new_vecs, d_X_half_vecs;
     std::vector<libMesh::PetscVector<double>*> d_U_current_vecs, d_U_new_vecs, d_U_half_vecs;
@@ -400,6 +434,13 @@ protected:
     libMeshEnums::QuadratureType d_quad_type;
     libMeshEnums::Order d_quad_order;
 
+    /*
+     * Subcycling parameters.  d_h_min is the minimum element size in the
+     * reference configuration.
+     */
+    int d_num_substeps;
+    double d_substep_cfl, d_wave_speed, d_h_min;
+
     /*
      * Functions used to compute the initial coordinates of the Lagrangian mesh.
      */
@@ -497,6 +538,17 @@ private:
         const std::vector<libMesh::Mesh*>& meshes,
         bool register_for_restart);
 
+    /*!
+     * Reallocate the work vector if it has not yet been allocated or if its
+     * parallel layout no longer matches that of the system vector (e.g.,
+     * because the mesh has been modified).  Otherwise, the existing work vector
+     * is reused.
+     */
+    static void
+    reinitializeWorkVector(
+        libMesh::PetscVector<double>*& work_vec,
+        const libMesh::PetscVector<double>& system_vec);
+
     /*!
      * Read input values from a given database.
      */